@@ -59,6 +59,7 @@ std::string DatabaseManager::buildConnectionString(const std::map<std::string, s
     if (config.count("password")) connStr += "password=" + config.at("password") + " ";
     if (config.count("host")) connStr += "host=" + config.at("host") + " ";
     if (config.count("port")) connStr += "port=" + config.at("port") + " ";
+    if (config.count("connect_timeout")) connStr += "connect_timeout=" + config.at("connect_timeout") + " ";
     
     // Trim trailing space if any
     if (!connStr.empty() && connStr.back() == ' ') {
@@ -67,7 +68,7 @@ std::string DatabaseManager::buildConnectionString(const std::map<std::string, s
     return connStr;
 }
 
-DatabaseManager::DatabaseManager(const std::string& configFilePath) : conn(nullptr) {
+DatabaseManager::DatabaseManager(const std::string& configFilePath, int connectTimeoutSeconds) : conn(nullptr) {
     try {
         std::map<std::string, std::string> config = loadConfig(configFilePath);
         std::string connectionString = buildConnectionString(config);
@@ -75,6 +76,10 @@ DatabaseManager::DatabaseManager(const std::string& configFilePath) : conn(nullp
         if (connectionString.empty()) {
             throw std::runtime_error("Failed to build connection string from config.");
         }
+        // libpq waits indefinitely by default
+        if (connectTimeoutSeconds > 0 && !config.count("connect_timeout")) {
+            connectionString += " connect_timeout=" + std::to_string(connectTimeoutSeconds);
+        }
 
         conn = new pqxx::connection(connectionString);
         if (!conn->is_open()) {
@@ -23,7 +23,8 @@ private:
 
 
 public:
-    DatabaseManager(const std::string& configFilePath);
+    // connectTimeoutSeconds > 0 bounds how long connecting may block, unless the config sets connect_timeout itself
+    DatabaseManager(const std::string& configFilePath, int connectTimeoutSeconds = 0);
     ~DatabaseManager();
 
     pqxx::result executeQuery(const std::string& query);
@@ -0,0 +1,53 @@
+/*
+ * File: GetCoalescer.cpp
+ * Description: Implements the GetCoalescer class.
+ * Author: David Paul Desuyo
+ * Date: 2025-06-04
+ */
+
+#include "GetCoalescer.h"
+
+std::shared_ptr<GetCoalescer::Flight> GetCoalescer::join(int productId, bool& leader) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = flights.find(productId);
+    if (it != flights.end()) {
+        leader = false;
+        return it->second;
+    }
+    auto flight = std::make_shared<Flight>();
+    flight->result = flight->promise.get_future().share();
+    flights.emplace(productId, flight);
+    leader = true;
+    return flight;
+}
+
+// The flight leaves the map before its result is published, so a GET arriving after the
+// answer is known always starts a fresh query rather than picking up an old one
+void GetCoalescer::complete(int productId, const std::shared_ptr<Flight>& flight, const std::optional<Product>& product) {
+    remove(productId, flight);
+    flight->promise.set_value(product);
+}
+
+void GetCoalescer::fail(int productId, const std::shared_ptr<Flight>& flight, std::exception_ptr error) {
+    remove(productId, flight);
+    flight->promise.set_exception(error);
+}
+
+void GetCoalescer::forget(int productId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    flights.erase(productId);
+}
+
+bool GetCoalescer::isInFlight(int productId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return flights.count(productId) > 0;
+}
+
+// A write may already have replaced this entry with a newer flight; only remove our own
+void GetCoalescer::remove(int productId, const std::shared_ptr<Flight>& flight) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = flights.find(productId);
+    if (it != flights.end() && it->second == flight) {
+        flights.erase(it);
+    }
+}
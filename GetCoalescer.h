@@ -0,0 +1,49 @@
+/*
+ * File: GetCoalescer.h
+ * Description: Tracks product lookups in flight so concurrent GETs for the same ID share one database query.
+ * Author: David Paul Desuyo
+ * Date: 2025-06-04
+ */
+
+#ifndef GETCOALESCER_H
+#define GETCOALESCER_H
+
+#include "Product.h"
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+class GetCoalescer {
+public:
+    using Lookup = std::shared_future<std::optional<Product>>;
+
+    struct Flight {
+        std::promise<std::optional<Product>> promise;
+        Lookup result;
+    };
+
+    // Returns the lookup in flight for productId, starting one if there is none. When leader
+    // is set the caller created it and must run the query, then call complete() or fail().
+    // Joiners just wait on flight->result; nobody else ever blocks on their behalf.
+    std::shared_ptr<Flight> join(int productId, bool& leader);
+
+    void complete(int productId, const std::shared_ptr<Flight>& flight, const std::optional<Product>& product);
+    void fail(int productId, const std::shared_ptr<Flight>& flight, std::exception_ptr error);
+
+    // Called after a write so GETs arriving later start a fresh query instead of
+    // joining one that may have read the row before the write committed.
+    void forget(int productId);
+
+    bool isInFlight(int productId); // For diagnostics and tests
+
+private:
+    std::mutex mutex;
+    std::unordered_map<int, std::shared_ptr<Flight>> flights;
+
+    void remove(int productId, const std::shared_ptr<Flight>& flight);
+};
+
+#endif // GETCOALESCER_H
@@ -10,15 +10,76 @@
 
 InventoryManager::InventoryManager(DatabaseManager& db) : dbManager(db) {}
 
+Product InventoryManager::productFromRow(const pqxx::row& row) {
+    return Product(
+        row[0].as<int>(),
+        row[1].as<std::string>(),
+        row[2].as<double>(),
+        row[3].as<int>()
+    );
+}
+
+int InventoryManager::insertProduct(pqxx::connection& conn, const std::string& name, double price, int quantity) {
+    // Use a parameterized query to prevent SQL injection
+    pqxx::work txn(conn);
+    pqxx::result res = txn.exec_params(
+        "INSERT INTO Products (product_name, price, quantity) VALUES ($1, $2, $3) RETURNING product_id",
+        name, price, quantity
+    );
+    txn.commit();
+    return res[0][0].as<int>();
+}
+
+// Single-statement reads run in a nontransaction (autocommit): a pqxx::work would add a
+// BEGIN and a COMMIT round trip around every lookup.
+std::optional<Product> InventoryManager::selectProductById(pqxx::connection& conn, int productId) {
+    pqxx::nontransaction txn(conn);
+    pqxx::result res = txn.exec_params(
+        "SELECT product_id, product_name, price, quantity FROM Products WHERE product_id = $1",
+        productId
+    );
+    if (res.empty()) {
+        return std::nullopt;
+    }
+    return productFromRow(res[0]);
+}
+
+std::vector<Product> InventoryManager::selectAllProducts(pqxx::connection& conn) {
+    pqxx::nontransaction txn(conn);
+    pqxx::result res = txn.exec("SELECT product_id, product_name, price, quantity FROM Products ORDER BY product_id");
+    std::vector<Product> products;
+    products.reserve(res.size()); // Pre-allocate memory
+    for (const auto& row : res) {
+        products.push_back(productFromRow(row));
+    }
+    return products;
+}
+
+bool InventoryManager::updateProductRow(pqxx::connection& conn, int productId, const std::string& name, double price, int quantity) {
+    pqxx::work txn(conn);
+    pqxx::result res = txn.exec_params(
+        "UPDATE Products SET product_name = $1, price = $2, quantity = $3 WHERE product_id = $4",
+        name, price, quantity, productId
+    );
+    txn.commit();
+    // Check if any row was updated
+    return res.affected_rows() > 0;
+}
+
+bool InventoryManager::deleteProductRow(pqxx::connection& conn, int productId) {
+    pqxx::work txn(conn);
+    pqxx::result res = txn.exec_params(
+        "DELETE FROM Products WHERE product_id = $1",
+        productId
+    );
+    txn.commit();
+    // Check if any row was deleted
+    return res.affected_rows() > 0;
+}
+
 bool InventoryManager::addProduct(const std::string& name, double price, int quantity) {
     try {
-        // Use a parameterized query to prevent SQL injection
-        pqxx::work txn(*dbManager.getConnection());
-        txn.exec_params( // Reverted to exec_params
-            "INSERT INTO Products (product_name, price, quantity) VALUES ($1, $2, $3)",
-            name, price, quantity
-        );
-        txn.commit();
+        insertProduct(*dbManager.getConnection(), name, price, quantity);
         return true;
     } catch (const std::exception& e) {
         std::cerr << "Error adding product: " << e.what() << std::endl;
@@ -28,23 +89,7 @@ bool InventoryManager::addProduct(const std::string& name, double price, int qua
 
 std::optional<Product> InventoryManager::getProductById(int productId) {
     try {
-        pqxx::work txn(*dbManager.getConnection());
-        pqxx::result res = txn.exec_params( // Reverted to exec_params
-            "SELECT product_id, product_name, price, quantity FROM Products WHERE product_id = $1",
-            productId
-        );
-        txn.commit();
-        if (!res.empty()) {
-            const auto& row = res[0];
-            Product product(
-                row[0].as<int>(),
-                row[1].as<std::string>(),
-                row[2].as<double>(),
-                row[3].as<int>()
-            );
-            return product;
-        }
-        return std::nullopt;
+        return selectProductById(*dbManager.getConnection(), productId);
     } catch (const std::exception& e) {
         std::cerr << "Error retrieving product: " << e.what() << std::endl;
         return std::nullopt;
@@ -76,24 +121,12 @@ std::vector<Product> InventoryManager::getAllProducts() {
 
 // Algorithm 1 (Originally efficient: single query, reserves memory)
 std::vector<Product> InventoryManager::getAllProductsAlgorithm1() {
-    std::vector<Product> products;
     try {
-        pqxx::work txn(*dbManager.getConnection());
-        pqxx::result res = txn.exec("SELECT product_id, product_name, price, quantity FROM Products ORDER BY product_id");
-        txn.commit();
-        products.reserve(res.size()); // Pre-allocate memory
-        for (const auto& row : res) {
-            products.emplace_back(
-                row[0].as<int>(),
-                row[1].as<std::string>(),
-                row[2].as<double>(),
-                row[3].as<int>()
-            );
-        }
+        return selectAllProducts(*dbManager.getConnection());
     } catch (const std::exception& e) {
         std::cerr << "Error retrieving products (Algorithm 1): " << e.what() << std::endl;
+        return {};
     }
-    return products;
 }
 
 // Algorithm 2 (Originally less efficient: N+1 queries)
@@ -132,14 +165,7 @@ std::vector<Product> InventoryManager::getAllProductsAlgorithm2() {
 
 bool InventoryManager::updateProduct(int productId, const std::string& name, double price, int quantity) {
     try {
-        pqxx::work txn(*dbManager.getConnection());
-        pqxx::result res = txn.exec_params( // Reverted to exec_params
-            "UPDATE Products SET product_name = $1, price = $2, quantity = $3 WHERE product_id = $4",
-            name, price, quantity, productId
-        );
-        txn.commit();
-        // Check if any row was updated
-        return res.affected_rows() > 0;
+        return updateProductRow(*dbManager.getConnection(), productId, name, price, quantity);
     } catch (const std::exception& e) {
         std::cerr << "Error updating product: " << e.what() << std::endl;
         return false;
@@ -148,14 +174,7 @@ bool InventoryManager::updateProduct(int productId, const std::string& name, dou
 
 bool InventoryManager::deleteProduct(int productId) {
     try {
-        pqxx::work txn(*dbManager.getConnection());
-        pqxx::result res = txn.exec_params( // Reverted to exec_params
-            "DELETE FROM Products WHERE product_id = $1",
-            productId
-        );
-        txn.commit();
-        // Check if any row was deleted
-        return res.affected_rows() > 0;
+        return deleteProductRow(*dbManager.getConnection(), productId);
     } catch (const std::exception& e) {
         std::cerr << "Error deleting product: " << e.what() << std::endl;
         return false;
@@ -17,9 +17,20 @@ class InventoryManager {
 private:
     DatabaseManager& dbManager;
 
+    static Product productFromRow(const pqxx::row& row);
+
 public:
     InventoryManager(DatabaseManager& db);
 
+    // Connection-level variants: these run on the caller's connection and throw on database
+    // errors instead of returning a sentinel, so callers can tell "not found" from "database down".
+    // The member functions below wrap them for the CLI.
+    static int insertProduct(pqxx::connection& conn, const std::string& name, double price, int quantity); // Returns the new product_id
+    static std::optional<Product> selectProductById(pqxx::connection& conn, int productId);
+    static std::vector<Product> selectAllProducts(pqxx::connection& conn);
+    static bool updateProductRow(pqxx::connection& conn, int productId, const std::string& name, double price, int quantity);
+    static bool deleteProductRow(pqxx::connection& conn, int productId);
+
     bool addProduct(const std::string& name, double price, int quantity);
     std::optional<Product> getProductById(int productId);
     std::vector<Product> getAllProductsAlgorithm1(); // Was getAllProductsEfficient
@@ -0,0 +1,423 @@
+/*
+ * File: InventoryServer.cpp
+ * Description: Implements the InventoryServer class (socket handling, request parsing, GET coalescing).
+ * Author: David Paul Desuyo
+ * Date: 2025-06-02
+ */
+
+#include "InventoryServer.h"
+#include <iostream>
+#include <sstream>      // For std::ostringstream
+#include <iomanip>      // For std::fixed, std::setprecision
+#include <cerrno>
+#include <chrono>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+using NativeSocket = SOCKET;
+static const NativeSocket INVALID_NATIVE_SOCKET = INVALID_SOCKET;
+static void closeNativeSocket(NativeSocket s) { closesocket(s); }
+static const int SHUTDOWN_BOTH = SD_BOTH;
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+using NativeSocket = int;
+static const NativeSocket INVALID_NATIVE_SOCKET = -1;
+static void closeNativeSocket(NativeSocket s) { close(s); }
+static const int SHUTDOWN_BOTH = SHUT_RDWR;
+#endif
+
+#ifdef MSG_NOSIGNAL
+static const int SEND_FLAGS = MSG_NOSIGNAL; // Don't let a vanished client kill the server with SIGPIPE
+#else
+static const int SEND_FLAGS = 0;
+#endif
+
+namespace {
+    const std::size_t MAX_LINE_LENGTH = 64 * 1024;
+    const std::size_t MAX_CLIENTS = 256;
+    const std::chrono::seconds RECONNECT_INTERVAL(1);
+    const int CONNECT_TIMEOUT_SECONDS = 5; // A reconnect during an outage must not hold a worker indefinitely
+
+    const char* const UNAVAILABLE_REPLY = "ERR database unavailable\n";
+    const char* const DATABASE_ERROR_REPLY = "ERR database error\n";
+
+    // Published to coalesced GETs whose leader lost its connection
+    struct DatabaseUnavailable : std::runtime_error {
+        DatabaseUnavailable() : std::runtime_error("database unavailable") {}
+    };
+
+    bool sendAll(NativeSocket s, const std::string& data) {
+        size_t sent = 0;
+        while (sent < data.size()) {
+            int n = send(s, data.data() + sent, static_cast<int>(data.size() - sent), SEND_FLAGS);
+            if (n <= 0) {
+                return false;
+            }
+            sent += static_cast<size_t>(n);
+        }
+        return true;
+    }
+}
+
+InventoryServer::InventoryServer(const std::string& configFilePath, unsigned short port, std::size_t workerCount)
+    : configFilePath(configFilePath), port(port), listenSocket(static_cast<SocketHandle>(INVALID_NATIVE_SOCKET)),
+      running(false), stopRequested(false), pool(workerCount) {
+#ifdef _WIN32
+    WSADATA wsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+        throw std::runtime_error("Failed to initialise Winsock.");
+    }
+#endif
+    // One connection per worker; DatabaseManager throws if any of them cannot connect at startup
+    contexts.reserve(pool.size());
+    for (std::size_t i = 0; i < pool.size(); ++i) {
+        auto context = std::make_unique<WorkerContext>();
+        context->dbManager = std::make_unique<DatabaseManager>(configFilePath, CONNECT_TIMEOUT_SECONDS);
+        contexts.push_back(std::move(context));
+    }
+}
+
+InventoryServer::~InventoryServer() {
+    stop();
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
+
+void InventoryServer::run() {
+    NativeSocket listener = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listener == INVALID_NATIVE_SOCKET) {
+        throw std::runtime_error("Failed to create listening socket.");
+    }
+
+    int reuse = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+
+    // Loopback only: the server is meant for local services, not the network
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+
+    if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(listener, SOMAXCONN) != 0) {
+        closeNativeSocket(listener);
+        throw std::runtime_error("Failed to listen on 127.0.0.1:" + std::to_string(port));
+    }
+
+    {
+        // stop() may already have been called (e.g. a signal during startup); don't start serving then
+        std::lock_guard<std::mutex> lock(listenMutex);
+        if (stopRequested) {
+            closeNativeSocket(listener);
+            return;
+        }
+        listenSocket = static_cast<SocketHandle>(listener);
+        running = true;
+    }
+    std::cout << "Inventory server listening on 127.0.0.1:" << port
+              << " with " << pool.size() << " workers." << std::endl;
+
+    while (running) {
+        NativeSocket client = accept(listener, nullptr, nullptr);
+        if (client == INVALID_NATIVE_SOCKET) {
+            if (!running) {
+                break;
+            }
+#ifndef _WIN32
+            if (errno == EINTR) {
+                continue; // Interrupted by a signal (e.g. the SIGINT that is about to call stop())
+            }
+#endif
+            // Persistent failures (e.g. out of file descriptors) would otherwise spin this loop
+            std::cerr << "Failed to accept client; retrying shortly." << std::endl;
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            continue;
+        }
+
+        // Responses are small and latency-bound; don't let Nagle hold them back
+        int noDelay = 1;
+        setsockopt(client, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&noDelay), sizeof(noDelay));
+
+        // Each client gets its own reader thread, so cap them rather than let thread count grow unbounded
+        bool full;
+        {
+            // Checking running under the lock means stop() can't miss a client registered after its sweep
+            std::lock_guard<std::mutex> lock(clientsMutex);
+            if (!running) {
+                closeNativeSocket(client);
+                break;
+            }
+            full = clientSockets.size() >= MAX_CLIENTS;
+            if (!full) {
+                clientSockets.insert(static_cast<SocketHandle>(client));
+            }
+        }
+        if (full) {
+            sendAll(client, "ERR server busy\n");
+            closeNativeSocket(client);
+            continue;
+        }
+
+        try {
+            std::thread(&InventoryServer::serveClient, this, static_cast<SocketHandle>(client)).detach();
+        } catch (const std::system_error& e) {
+            // Nothing will ever remove this socket, so undo the registration or stop() would wait forever
+            std::cerr << "Failed to start client thread: " << e.what() << std::endl;
+            std::lock_guard<std::mutex> lock(clientsMutex);
+            clientSockets.erase(static_cast<SocketHandle>(client));
+            closeNativeSocket(client);
+            clientsDone.notify_all();
+        }
+    }
+
+#ifndef _WIN32
+    closeNativeSocket(listener); // On Windows stop() has already closed it to wake accept()
+#endif
+}
+
+void InventoryServer::stop() {
+    {
+        std::lock_guard<std::mutex> lock(listenMutex);
+        stopRequested = true;
+        running = false;
+        if (listenSocket != static_cast<SocketHandle>(INVALID_NATIVE_SOCKET)) {
+            NativeSocket listener = static_cast<NativeSocket>(listenSocket);
+#ifdef _WIN32
+            closeNativeSocket(listener); // shutdown() does not wake accept() on Winsock
+#else
+            shutdown(listener, SHUTDOWN_BOTH); // Wakes accept(); run() closes the socket once it returns
+#endif
+            listenSocket = static_cast<SocketHandle>(INVALID_NATIVE_SOCKET);
+        }
+    }
+
+    // Kick every connected client out of recv() and wait for their threads to finish
+    std::unique_lock<std::mutex> lock(clientsMutex);
+    for (SocketHandle client : clientSockets) {
+        shutdown(static_cast<NativeSocket>(client), SHUTDOWN_BOTH);
+    }
+    clientsDone.wait(lock, [this] { return clientSockets.empty(); });
+}
+
+void InventoryServer::serveClient(SocketHandle handle) {
+    NativeSocket client = static_cast<NativeSocket>(handle);
+    std::string buffer;
+    char chunk[16 * 1024];
+
+    while (true) {
+        int n = recv(client, chunk, sizeof(chunk), 0);
+        if (n <= 0) {
+            break;
+        }
+        buffer.append(chunk, static_cast<size_t>(n));
+
+        std::vector<ServerRequest> requests;
+        size_t lineStart = 0;
+        size_t newline;
+        while ((newline = buffer.find('\n', lineStart)) != std::string::npos) {
+            std::string line = buffer.substr(lineStart, newline - lineStart);
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            lineStart = newline + 1;
+            requests.push_back(parseRequest(line));
+        }
+        buffer.erase(0, lineStart);
+
+        // Every complete line in this read becomes its own task so a pipelined batch is
+        // spread over the pool; runPipelinedBatch keeps replies in order and writes as barriers
+        std::string reply = runPipelinedBatch(requests, [this](const ServerRequest& request) {
+            return startRequest(request);
+        });
+
+        if (!reply.empty() && !sendAll(client, reply)) {
+            break;
+        }
+        if (buffer.size() > MAX_LINE_LENGTH) {
+            sendAll(client, "ERR request too long\n");
+            break;
+        }
+    }
+
+    // Close under the lock so stop() never shuts down a descriptor number that accept() has reused
+    std::lock_guard<std::mutex> lock(clientsMutex);
+    clientSockets.erase(handle);
+    closeNativeSocket(client);
+    clientsDone.notify_all();
+}
+
+// Begins one request and returns a waiter for its reply
+ReplyWaiter InventoryServer::startRequest(const ServerRequest& request) {
+    // PING and malformed requests don't need the database, so answer them here: they
+    // must not wait for a worker (or its reconnect) or report the database as unavailable
+    if (request.type == ServerRequest::Type::Ping || request.type == ServerRequest::Type::Invalid) {
+        std::string immediate = (request.type == ServerRequest::Type::Ping) ? "OK\n" : request.errorReply;
+        return [immediate] { return immediate; };
+    }
+
+    // A GET joins any lookup already in flight for its ID; only the GET that starts
+    // a lookup takes a worker, so hot-key traffic never parks workers on each other
+    if (request.type == ServerRequest::Type::Get) {
+        bool leader = false;
+        auto flight = coalescer.join(request.productId, leader);
+        if (leader) {
+            int productId = request.productId;
+            pool.submit([this, productId, flight](std::size_t workerIndex) {
+                runLookup(productId, flight, workerIndex);
+            });
+        }
+        GetCoalescer::Lookup lookup = flight->result;
+        return [lookup] { return lookupReply(lookup); };
+    }
+
+    auto promise = std::make_shared<std::promise<std::string>>();
+    auto future = std::make_shared<std::future<std::string>>(promise->get_future());
+    pool.submit([this, promise, request](std::size_t workerIndex) {
+        try {
+            promise->set_value(handleRequest(request, workerIndex));
+        } catch (const std::exception& e) {
+            promise->set_value(std::string("ERR ") + e.what() + "\n");
+        }
+    });
+    return [future] { return future->get(); };
+}
+
+std::string InventoryServer::handleRequest(const ServerRequest& request, std::size_t workerIndex) {
+    WorkerContext& context = *contexts[workerIndex];
+    if (!ensureConnected(context)) {
+        return UNAVAILABLE_REPLY;
+    }
+    try {
+        return executeRequest(request, *context.dbManager->getConnection());
+    } catch (const pqxx::broken_connection& e) {
+        return recordDatabaseFailure(context, e, true) ? UNAVAILABLE_REPLY : DATABASE_ERROR_REPLY;
+    } catch (const std::exception& e) {
+        return recordDatabaseFailure(context, e, false) ? UNAVAILABLE_REPLY : DATABASE_ERROR_REPLY;
+    }
+}
+
+// Runs the query for a coalesced GET on this worker and publishes the outcome to every request
+// waiting on the flight. A lost connection is published as DatabaseUnavailable, since the
+// waiters have no connection of their own to inspect.
+void InventoryServer::runLookup(int productId, const std::shared_ptr<GetCoalescer::Flight>& flight, std::size_t workerIndex) {
+    WorkerContext& context = *contexts[workerIndex];
+    if (!ensureConnected(context)) {
+        coalescer.fail(productId, flight, std::make_exception_ptr(DatabaseUnavailable()));
+        return;
+    }
+    try {
+        coalescer.complete(productId, flight,
+                           InventoryManager::selectProductById(*context.dbManager->getConnection(), productId));
+    } catch (const pqxx::broken_connection& e) {
+        recordDatabaseFailure(context, e, true);
+        coalescer.fail(productId, flight, std::make_exception_ptr(DatabaseUnavailable()));
+    } catch (const std::exception& e) {
+        bool unavailable = recordDatabaseFailure(context, e, false);
+        coalescer.fail(productId, flight,
+                       unavailable ? std::make_exception_ptr(DatabaseUnavailable()) : std::current_exception());
+    }
+}
+
+std::string InventoryServer::lookupReply(const GetCoalescer::Lookup& lookup) {
+    try {
+        const std::optional<Product>& product = lookup.get();
+        return product ? "OK " + formatProduct(*product) + "\n" : "ERR not found\n";
+    } catch (const DatabaseUnavailable&) {
+        return UNAVAILABLE_REPLY;
+    } catch (const std::exception&) {
+        return DATABASE_ERROR_REPLY;
+    }
+}
+
+// Reopens this worker's connection if it has been lost (e.g. after a Postgres restart).
+// Attempts are throttled so a database outage doesn't turn every request into a connect.
+bool InventoryServer::ensureConnected(WorkerContext& context) {
+    if (context.dbManager && context.dbManager->getConnection()->is_open()) {
+        return true;
+    }
+    context.dbManager.reset();
+
+    auto now = std::chrono::steady_clock::now();
+    if (now < context.nextReconnectAttempt) {
+        return false;
+    }
+    try {
+        context.dbManager = std::make_unique<DatabaseManager>(configFilePath, CONNECT_TIMEOUT_SECONDS);
+        return true;
+    } catch (const std::exception&) {
+        // DatabaseManager has already logged the reason
+        context.nextReconnectAttempt = now + RECONNECT_INTERVAL;
+        return false;
+    }
+}
+
+// Logs the failure and drops this worker's connection if it is gone. Returns true when the
+// failure means the database is unavailable rather than that the query itself failed.
+bool InventoryServer::recordDatabaseFailure(WorkerContext& context, const std::exception& e, bool brokenConnection) {
+    std::cerr << "Request failed: " << e.what() << std::endl;
+    bool connectionLost = !context.dbManager->getConnection()->is_open();
+    if (connectionLost) {
+        context.dbManager.reset(); // Reconnected by ensureConnected() on this worker's next request
+    }
+    return brokenConnection || connectionLost;
+}
+
+// Uses InventoryManager's connection-level variants, which let exceptions propagate: its
+// member functions report failures as "not found"/empty results, which a client could not
+// tell apart from real answers.
+std::string InventoryServer::executeRequest(const ServerRequest& request, pqxx::connection& conn) {
+    switch (request.type) {
+        case ServerRequest::Type::Ping:
+            return "OK\n";
+        case ServerRequest::Type::Get: {
+            // serveClient routes GETs through the coalescer; this uncoalesced path keeps the switch complete
+            auto product = InventoryManager::selectProductById(conn, request.productId);
+            return product ? "OK " + formatProduct(*product) + "\n" : "ERR not found\n";
+        }
+        case ServerRequest::Type::List: {
+            std::vector<Product> products = InventoryManager::selectAllProducts(conn);
+            std::string reply = "OK " + std::to_string(products.size()) + "\n";
+            for (const auto& p : products) {
+                reply += formatProduct(p) + "\n";
+            }
+            return reply;
+        }
+        case ServerRequest::Type::Add: {
+            int id = InventoryManager::insertProduct(conn, request.name, request.price, request.quantity);
+            // A GET for the new ID that was already in flight may have missed the row; don't let later GETs join it
+            coalescer.forget(id);
+            return "OK " + std::to_string(id) + "\n";
+        }
+        case ServerRequest::Type::Update: {
+            bool updated = InventoryManager::updateProductRow(conn, request.productId, request.name, request.price, request.quantity);
+            coalescer.forget(request.productId);
+            return updated ? "OK\n" : "ERR not found\n";
+        }
+        case ServerRequest::Type::Delete: {
+            bool deleted = InventoryManager::deleteProductRow(conn, request.productId);
+            coalescer.forget(request.productId);
+            return deleted ? "OK\n" : "ERR not found\n";
+        }
+        case ServerRequest::Type::Invalid:
+            break;
+    }
+    return request.errorReply;
+}
+
+std::string InventoryServer::formatProduct(const Product& product) {
+    std::ostringstream oss;
+    oss << product.productId << ' '
+        << std::fixed << std::setprecision(2) << product.price << ' '
+        << product.quantity << ' '
+        << product.productName;
+    return oss.str();
+}
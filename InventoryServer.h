@@ -0,0 +1,95 @@
+/*
+ * File: InventoryServer.h
+ * Description: Long-running TCP front-end that serves the InventoryManager CRUD operations on a work-stealing thread pool.
+ * Author: David Paul Desuyo
+ * Date: 2025-06-02
+ */
+
+#ifndef INVENTORYSERVER_H
+#define INVENTORYSERVER_H
+
+#include "InventoryManager.h"
+#include "DatabaseManager.h"
+#include "ServerProtocol.h"
+#include "GetCoalescer.h"
+#include "WorkStealingPool.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/*
+ * Line protocol (one request per line, one response per request, answered in order):
+ *
+ *   PING                                  -> OK
+ *   GET <id>                              -> OK <id> <price> <quantity> <name> | ERR not found
+ *   LIST                                  -> OK <count>, followed by <count> lines of "<id> <price> <quantity> <name>"
+ *   ADD <price> <quantity> <name>         -> OK <new id> | ERR <reason>
+ *   UPDATE <id> <price> <quantity> <name> -> OK | ERR <reason>
+ *   DELETE <id>                           -> OK | ERR not found
+ *
+ * Any request that touches the database may also answer "ERR database unavailable" (the worker's
+ * connection is down and will be reopened) or "ERR database error" (the query itself failed).
+ *
+ * The name is always the last field so it may contain spaces. Clients may pipeline several
+ * requests; each batch read from the socket is executed in parallel across the pool.
+ */
+class InventoryServer {
+public:
+    InventoryServer(const std::string& configFilePath, unsigned short port, std::size_t workerCount);
+    ~InventoryServer();
+
+    InventoryServer(const InventoryServer&) = delete;
+    InventoryServer& operator=(const InventoryServer&) = delete;
+
+    void run();   // Accepts clients until stop() is called
+    void stop();  // Safe to call from another thread; waits for connected clients to finish
+
+private:
+    using SocketHandle = std::intptr_t;
+
+    // Each worker owns its own connection, so no database state is shared between threads.
+    // dbManager is null while the connection is down.
+    struct WorkerContext {
+        std::unique_ptr<DatabaseManager> dbManager;
+        std::chrono::steady_clock::time_point nextReconnectAttempt;
+    };
+
+    std::vector<std::unique_ptr<WorkerContext>> contexts;
+
+    GetCoalescer coalescer;
+
+    std::string configFilePath;
+    unsigned short port;
+    std::mutex listenMutex;
+    SocketHandle listenSocket;
+    std::atomic<bool> running;
+    bool stopRequested;  // Guarded by listenMutex
+
+    std::mutex clientsMutex;
+    std::condition_variable clientsDone;
+    std::unordered_set<SocketHandle> clientSockets;
+
+    // Declared last so its workers are joined before the contexts they use are destroyed
+    WorkStealingPool pool;
+
+    void serveClient(SocketHandle client);
+    ReplyWaiter startRequest(const ServerRequest& request);
+    std::string handleRequest(const ServerRequest& request, std::size_t workerIndex);
+    std::string executeRequest(const ServerRequest& request, pqxx::connection& conn);
+    bool ensureConnected(WorkerContext& context);
+    bool recordDatabaseFailure(WorkerContext& context, const std::exception& e, bool brokenConnection);
+    void runLookup(int productId, const std::shared_ptr<GetCoalescer::Flight>& flight, std::size_t workerIndex);
+
+    static std::string lookupReply(const GetCoalescer::Lookup& lookup);
+    static std::string formatProduct(const Product& product);
+};
+
+#endif // INVENTORYSERVER_H
@@ -0,0 +1,142 @@
+/*
+ * File: ServerProtocol.cpp
+ * Description: Implements request parsing for InventoryServer's line protocol.
+ * Author: David Paul Desuyo
+ * Date: 2025-06-04
+ */
+
+#include "ServerProtocol.h"
+#include <climits>      // For INT_MIN, INT_MAX
+#include <cmath>        // For std::isfinite
+
+namespace {
+    // Returns the next space-separated token at or after pos and moves pos past it
+    std::string nextToken(const std::string& line, size_t& pos) {
+        size_t start = line.find_first_not_of(' ', pos);
+        if (start == std::string::npos) {
+            pos = line.size();
+            return "";
+        }
+        size_t end = line.find(' ', start);
+        if (end == std::string::npos) {
+            end = line.size();
+        }
+        pos = end;
+        return line.substr(start, end - start);
+    }
+
+    // The product name is everything left on the line, so it may contain spaces
+    std::string restOfLine(const std::string& line, size_t pos) {
+        size_t start = line.find_first_not_of(' ', pos);
+        return (start == std::string::npos) ? "" : line.substr(start);
+    }
+
+    bool parseInt(const std::string& token, int& value) {
+        if (token.empty()) {
+            return false;
+        }
+        try {
+            size_t used = 0;
+            long long parsed = std::stoll(token, &used);
+            if (used != token.size() || parsed < INT_MIN || parsed > INT_MAX) {
+                return false;
+            }
+            value = static_cast<int>(parsed);
+            return true;
+        } catch (const std::exception&) {
+            return false; // Not a number, or out of range for long long
+        }
+    }
+
+    bool parseDouble(const std::string& token, double& value) {
+        if (token.empty()) {
+            return false;
+        }
+        try {
+            size_t used = 0;
+            double parsed = std::stod(token, &used);
+            if (used != token.size() || !std::isfinite(parsed)) {
+                return false;
+            }
+            value = parsed;
+            return true;
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    ServerRequest invalid(const std::string& reply) {
+        ServerRequest request;
+        request.errorReply = reply;
+        return request;
+    }
+}
+
+bool ServerRequest::isWrite() const {
+    return type == Type::Add || type == Type::Update || type == Type::Delete;
+}
+
+ServerRequest parseRequest(const std::string& line) {
+    size_t pos = 0;
+    std::string command = nextToken(line, pos);
+    ServerRequest request;
+
+    if (command == "PING" || command == "LIST") {
+        if (!nextToken(line, pos).empty()) {
+            return invalid("ERR usage: " + command + "\n");
+        }
+        request.type = (command == "PING") ? ServerRequest::Type::Ping : ServerRequest::Type::List;
+        return request;
+    }
+    if (command == "GET" || command == "DELETE") {
+        if (!parseInt(nextToken(line, pos), request.productId) || !nextToken(line, pos).empty()) {
+            return invalid("ERR usage: " + command + " <id>\n");
+        }
+        request.type = (command == "GET") ? ServerRequest::Type::Get : ServerRequest::Type::Delete;
+        return request;
+    }
+    if (command == "ADD") {
+        if (!parseDouble(nextToken(line, pos), request.price) ||
+            !parseInt(nextToken(line, pos), request.quantity) ||
+            (request.name = restOfLine(line, pos)).empty()) {
+            return invalid("ERR usage: ADD <price> <quantity> <name>\n");
+        }
+        request.type = ServerRequest::Type::Add;
+        return request;
+    }
+    if (command == "UPDATE") {
+        if (!parseInt(nextToken(line, pos), request.productId) ||
+            !parseDouble(nextToken(line, pos), request.price) ||
+            !parseInt(nextToken(line, pos), request.quantity) ||
+            (request.name = restOfLine(line, pos)).empty()) {
+            return invalid("ERR usage: UPDATE <id> <price> <quantity> <name>\n");
+        }
+        request.type = ServerRequest::Type::Update;
+        return request;
+    }
+    return invalid("ERR unknown command\n");
+}
+
+std::string runPipelinedBatch(const std::vector<ServerRequest>& requests,
+                              const std::function<ReplyWaiter(const ServerRequest&)>& start) {
+    std::string reply;
+    std::vector<ReplyWaiter> pending;
+    auto drainPending = [&reply, &pending]() {
+        for (auto& waitForReply : pending) {
+            reply += waitForReply();
+        }
+        pending.clear();
+    };
+
+    for (const auto& request : requests) {
+        if (request.isWrite()) {
+            drainPending();
+        }
+        pending.push_back(start(request));
+        if (request.isWrite()) {
+            drainPending();
+        }
+    }
+    drainPending();
+    return reply;
+}
@@ -0,0 +1,42 @@
+/*
+ * File: ServerProtocol.h
+ * Description: Parses InventoryServer's line protocol and orders pipelined batches. Free of sockets and pqxx so it can be tested on its own.
+ * Author: David Paul Desuyo
+ * Date: 2025-06-04
+ */
+
+#ifndef SERVERPROTOCOL_H
+#define SERVERPROTOCOL_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+struct ServerRequest {
+    enum class Type { Ping, Get, List, Add, Update, Delete, Invalid };
+
+    Type type = Type::Invalid;
+    int productId = 0;       // GET, UPDATE, DELETE
+    double price = 0.0;      // ADD, UPDATE
+    int quantity = 0;        // ADD, UPDATE
+    std::string name;        // ADD, UPDATE
+    std::string errorReply;  // Complete "ERR ...\n" reply when type is Invalid
+
+    bool isWrite() const;
+};
+
+// Parses one request line (without its trailing newline). Every numeric field must be a
+// complete token: "GET 7abc" or "DELETE 12.7" are usage errors, never a different request.
+ServerRequest parseRequest(const std::string& line);
+
+// Waits for one request's reply and returns it
+using ReplyWaiter = std::function<std::string()>;
+
+// Runs one batch of pipelined requests and returns their replies concatenated in request order.
+// start() begins a request and returns a waiter for its reply. Requests start back to back so
+// they run in parallel, except that a write acts as a barrier: it starts only once every earlier
+// reply is in, and nothing after it starts until its own reply is in.
+std::string runPipelinedBatch(const std::vector<ServerRequest>& requests,
+                              const std::function<ReplyWaiter(const ServerRequest&)>& start);
+
+#endif // SERVERPROTOCOL_H
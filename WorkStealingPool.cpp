@@ -0,0 +1,112 @@
+/*
+ * File: WorkStealingPool.cpp
+ * Description: Implements the WorkStealingPool class.
+ * Author: David Paul Desuyo
+ * Date: 2025-06-02
+ */
+
+#include "WorkStealingPool.h"
+#include <iostream>
+
+WorkStealingPool::WorkStealingPool(std::size_t threadCount)
+    : nextQueue(0), pendingTasks(0), stopping(false) {
+    if (threadCount == 0) {
+        threadCount = 1;
+    }
+    queues.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    workers.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    sleepCondition.notify_all();
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void WorkStealingPool::submit(Task task) {
+    // Spread submissions round-robin so no single queue becomes the hot spot
+    std::size_t index = nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    {
+        // pendingTasks only changes under a queue lock, so it always matches what the queues hold
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+        pendingTasks.fetch_add(1, std::memory_order_release);
+    }
+    {
+        // Orders the increment against a worker that has checked the counter but not yet started waiting
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    sleepCondition.notify_one();
+}
+
+std::size_t WorkStealingPool::size() const {
+    return workers.size();
+}
+
+// Owner takes from the front too: every task is an external request pushed round-robin,
+// so oldest-first keeps one request from starving behind newer ones under load
+bool WorkStealingPool::popLocal(std::size_t index, Task& task) {
+    WorkerQueue& queue = *queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    pendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+}
+
+// Thieves take the oldest task as well, for the same fairness reason
+bool WorkStealingPool::steal(std::size_t thiefIndex, Task& task) {
+    const std::size_t count = queues.size();
+    for (std::size_t offset = 1; offset < count; ++offset) {
+        // A plain lock: the critical sections are a few instructions, and skipping a busy
+        // queue would mean some work is only found by polling
+        WorkerQueue& victim = *queues[(thiefIndex + offset) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.tasks.empty()) {
+            continue;
+        }
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        pendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::workerLoop(std::size_t index) {
+    while (true) {
+        Task task;
+        if (popLocal(index, task) || steal(index, task)) {
+            try {
+                task(index);
+            } catch (const std::exception& e) {
+                std::cerr << "Worker " << index << " task error: " << e.what() << std::endl;
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        if (stopping && pendingTasks.load(std::memory_order_acquire) == 0) {
+            break;
+        }
+        sleepCondition.wait(lock, [this] {
+            return stopping || pendingTasks.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * File: WorkStealingPool.h
+ * Description: Fixed-size thread pool where each worker owns a task deque and idle workers steal from the others.
+ * Author: David Paul Desuyo
+ * Date: 2025-06-02
+ */
+
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkStealingPool {
+public:
+    // A task receives the index of the worker running it, so callers can keep per-worker state
+    // (e.g. one database connection per worker) without any locking.
+    using Task = std::function<void(std::size_t workerIndex)>;
+
+    explicit WorkStealingPool(std::size_t threadCount);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    void submit(Task task);
+    std::size_t size() const;
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::atomic<std::size_t> nextQueue;   // Round-robin target for the next submission
+    std::atomic<std::size_t> pendingTasks;
+    std::atomic<bool> stopping;
+
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+
+    void workerLoop(std::size_t index);
+    bool popLocal(std::size_t index, Task& task);
+    bool steal(std::size_t thiefIndex, Task& task);
+};
+
+#endif // WORKSTEALINGPOOL_H
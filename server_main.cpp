@@ -0,0 +1,122 @@
+/*
+ * File: server_main.cpp
+ * Description: Entry point for the Inventory Management server mode.
+ * Author: David Paul Desuyo
+ * Date: 2025-06-02
+ */
+
+#include <atomic>
+#include <chrono>
+#include <csignal>     // For std::signal
+#include <iostream>
+#include <string>
+#include <thread>      // For std::thread::hardware_concurrency
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>   // For SetConsoleCtrlHandler
+#endif
+
+#include "InventoryServer.h"
+
+// Set from the signal / console handler, where only a lock-free atomic store is safe.
+// A watcher thread turns it into a proper InventoryServer::stop() call.
+static std::atomic<bool> stopSignalled(false);
+
+#ifdef _WIN32
+static BOOL WINAPI handleConsoleEvent(DWORD) {
+    stopSignalled = true;
+    return TRUE;
+}
+#else
+static void handleStopSignal(int) {
+    stopSignalled = true;
+}
+#endif
+
+// Each worker holds its own connection; stay well below Postgres' default max_connections (100)
+static const unsigned long MAX_WORKERS = 64;
+
+// Parses a whole decimal argument within [minValue, maxValue]; rejects signs, junk and overflow
+static bool parseBoundedNumber(const std::string& text, unsigned long minValue, unsigned long maxValue, unsigned long& value) {
+    if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) {
+        return false;
+    }
+    try {
+        value = std::stoul(text);
+    } catch (const std::exception&) {
+        return false; // Out of range for unsigned long
+    }
+    return value >= minValue && value <= maxValue;
+}
+
+static void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [port 1-65535] [workers 1-" << MAX_WORKERS << "]" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::string configFilePath = "db_config.ini"; // Expect db_config.ini to be in the CWD, same as the CLI
+    unsigned short port = 5555;
+    std::size_t workerCount = std::thread::hardware_concurrency();
+    if (workerCount == 0) {
+        workerCount = 1; // hardware_concurrency() may be unknown
+    } else if (workerCount > MAX_WORKERS) {
+        workerCount = MAX_WORKERS;
+    }
+
+    unsigned long value;
+    if (argc > 3) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (argc > 1) {
+        if (!parseBoundedNumber(argv[1], 1, 65535, value)) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        port = static_cast<unsigned short>(value);
+    }
+    if (argc > 2) {
+        if (!parseBoundedNumber(argv[2], 1, MAX_WORKERS, value)) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        workerCount = static_cast<std::size_t>(value);
+    }
+
+#ifdef _WIN32
+    SetConsoleCtrlHandler(handleConsoleEvent, TRUE);
+#else
+    std::signal(SIGINT, handleStopSignal);
+    std::signal(SIGTERM, handleStopSignal);
+#endif
+
+    try {
+        InventoryServer server(configFilePath, port, workerCount);
+
+        std::atomic<bool> serverFinished(false);
+        std::thread watcher([&server, &serverFinished] {
+            while (!stopSignalled && !serverFinished) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+            if (stopSignalled) {
+                std::cout << "Shutting down..." << std::endl;
+            }
+            server.stop();
+        });
+
+        try {
+            server.run();
+        } catch (...) {
+            serverFinished = true;
+            watcher.join();
+            throw;
+        }
+        serverFinished = true;
+        watcher.join();
+    } catch (const std::exception& e) {
+        std::cerr << "Server error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * File: tests/GetCoalescerTest.cpp
+ * Description: Standalone checks for GetCoalescer's flight sharing and ownership rules (no database required).
+ * Author: David Paul Desuyo
+ * Date: 2025-06-04
+ */
+
+#include "GetCoalescer.h"
+#include <iostream>
+#include <stdexcept>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                          \
+    do {                                                                          \
+        if (!(condition)) {                                                       \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: "        \
+                      << #condition << std::endl;                                 \
+            ++failures;                                                           \
+        }                                                                         \
+    } while (0)
+
+// The first GET leads; later GETs for the same ID join it and receive its result
+static void testJoinersShareTheLeadersResult() {
+    GetCoalescer coalescer;
+    bool leader = false;
+    auto first = coalescer.join(1, leader);
+    CHECK(leader);
+
+    bool secondLeader = true;
+    auto second = coalescer.join(1, secondLeader);
+    CHECK(!secondLeader);
+    CHECK(second == first);
+
+    bool otherLeader = false;
+    coalescer.join(2, otherLeader);
+    CHECK(otherLeader); // Different IDs never share a flight
+
+    coalescer.complete(1, first, Product(1, "Widget", 9.99, 5));
+    CHECK(!coalescer.isInFlight(1));
+    GetCoalescer::Lookup lookup = second->result;
+    CHECK(lookup.get().has_value());
+    CHECK(lookup.get()->productName == "Widget");
+}
+
+// Once a lookup has finished, the next GET must start a fresh one
+static void testCompletedFlightIsNotReused() {
+    GetCoalescer coalescer;
+    bool leader = false;
+    auto first = coalescer.join(1, leader);
+    coalescer.complete(1, first, std::nullopt);
+
+    bool nextLeader = false;
+    auto next = coalescer.join(1, nextLeader);
+    CHECK(nextLeader);
+    CHECK(next != first);
+}
+
+// After a write forgets a flight, its old leader must not remove the newer flight on completion
+static void testOldLeaderDoesNotRemoveNewerFlight() {
+    GetCoalescer coalescer;
+    bool leader = false;
+    auto stale = coalescer.join(1, leader);
+
+    coalescer.forget(1); // e.g. an UPDATE committed while the lookup was running
+    bool newLeader = false;
+    auto fresh = coalescer.join(1, newLeader);
+    CHECK(newLeader);
+    CHECK(fresh != stale);
+
+    coalescer.complete(1, stale, std::nullopt);
+    CHECK(coalescer.isInFlight(1));
+
+    bool joinedLeader = true;
+    auto joined = coalescer.join(1, joinedLeader);
+    CHECK(!joinedLeader);
+    CHECK(joined == fresh);
+}
+
+// The error path follows the same ownership rule, and joiners see the leader's exception
+static void testFailureReachesJoinersAndRespectsOwnership() {
+    GetCoalescer coalescer;
+    bool leader = false;
+    auto stale = coalescer.join(1, leader);
+    bool joinerLeader = true;
+    auto joiner = coalescer.join(1, joinerLeader);
+
+    coalescer.forget(1);
+    bool newLeader = false;
+    coalescer.join(1, newLeader);
+
+    coalescer.fail(1, stale, std::make_exception_ptr(std::runtime_error("connection lost")));
+    CHECK(coalescer.isInFlight(1));
+
+    bool threw = false;
+    try {
+        joiner->result.get();
+    } catch (const std::runtime_error& e) {
+        threw = std::string(e.what()) == "connection lost";
+    }
+    CHECK(threw);
+}
+
+int main() {
+    testJoinersShareTheLeadersResult();
+    testCompletedFlightIsNotReused();
+    testOldLeaderDoesNotRemoveNewerFlight();
+    testFailureReachesJoinersAndRespectsOwnership();
+
+    if (failures != 0) {
+        std::cerr << failures << " check(s) failed." << std::endl;
+        return 1;
+    }
+    std::cout << "All GetCoalescer checks passed." << std::endl;
+    return 0;
+}
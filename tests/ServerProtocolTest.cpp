@@ -0,0 +1,153 @@
+/*
+ * File: tests/ServerProtocolTest.cpp
+ * Description: Standalone checks for request parsing and pipelined batch ordering (no database required).
+ * Author: David Paul Desuyo
+ * Date: 2025-06-04
+ */
+
+#include "ServerProtocol.h"
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                          \
+    do {                                                                          \
+        if (!(condition)) {                                                       \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: "        \
+                      << #condition << std::endl;                                 \
+            ++failures;                                                           \
+        }                                                                         \
+    } while (0)
+
+using Type = ServerRequest::Type;
+
+static void testValidRequests() {
+    CHECK(parseRequest("PING").type == Type::Ping);
+    CHECK(parseRequest("LIST").type == Type::List);
+
+    ServerRequest get = parseRequest("GET 42");
+    CHECK(get.type == Type::Get);
+    CHECK(get.productId == 42);
+
+    ServerRequest del = parseRequest("DELETE  7");
+    CHECK(del.type == Type::Delete);
+    CHECK(del.productId == 7);
+
+    ServerRequest add = parseRequest("ADD 9.99 5 Blue  Widget");
+    CHECK(add.type == Type::Add);
+    CHECK(add.price == 9.99);
+    CHECK(add.quantity == 5);
+    CHECK(add.name == "Blue  Widget"); // Inner spacing of the name is kept
+
+    ServerRequest update = parseRequest("UPDATE 3 2.50 10 Gear 5");
+    CHECK(update.type == Type::Update);
+    CHECK(update.productId == 3);
+    CHECK(update.price == 2.50);
+    CHECK(update.quantity == 10);
+    CHECK(update.name == "Gear 5");
+}
+
+// Each of these used to be carried out as a different request
+static void testPartialNumbersAreRejected() {
+    ServerRequest del = parseRequest("DELETE 12.7");
+    CHECK(del.type == Type::Invalid);
+    CHECK(del.errorReply == "ERR usage: DELETE <id>\n");
+
+    ServerRequest update = parseRequest("UPDATE 3.9 10 5 Widget");
+    CHECK(update.type == Type::Invalid);
+    CHECK(update.errorReply == "ERR usage: UPDATE <id> <price> <quantity> <name>\n");
+
+    ServerRequest add = parseRequest("ADD 5 3.5 Widget");
+    CHECK(add.type == Type::Invalid);
+    CHECK(add.errorReply == "ERR usage: ADD <price> <quantity> <name>\n");
+
+    ServerRequest get = parseRequest("GET 7abc");
+    CHECK(get.type == Type::Invalid);
+    CHECK(get.errorReply == "ERR usage: GET <id>\n");
+}
+
+static void testMalformedRequests() {
+    CHECK(parseRequest("GET").type == Type::Invalid);
+    CHECK(parseRequest("GET 1 2").type == Type::Invalid);
+    CHECK(parseRequest("GET 99999999999").type == Type::Invalid);          // Out of int range
+    CHECK(parseRequest("GET 99999999999999999999999").type == Type::Invalid);
+    CHECK(parseRequest("DELETE").type == Type::Invalid);
+    CHECK(parseRequest("LIST all").type == Type::Invalid);
+    CHECK(parseRequest("PING now").errorReply == "ERR usage: PING\n");
+    CHECK(parseRequest("ADD 1 1").type == Type::Invalid);                  // No name
+    CHECK(parseRequest("ADD 1 1   ").type == Type::Invalid);               // Blank name
+    CHECK(parseRequest("ADD nan 1 x").type == Type::Invalid);
+    CHECK(parseRequest("ADD inf 1 x").type == Type::Invalid);
+    CHECK(parseRequest("ADD 1e400 1 x").type == Type::Invalid);
+    CHECK(parseRequest("UPDATE 1 2 3").type == Type::Invalid);
+    CHECK(parseRequest("get 1").errorReply == "ERR unknown command\n");    // Commands are case-sensitive
+    CHECK(parseRequest("").errorReply == "ERR unknown command\n");
+}
+
+static void testIsWrite() {
+    CHECK(parseRequest("ADD 1 1 x").isWrite());
+    CHECK(parseRequest("UPDATE 1 1 1 x").isWrite());
+    CHECK(parseRequest("DELETE 1").isWrite());
+    CHECK(!parseRequest("GET 1").isWrite());
+    CHECK(!parseRequest("LIST").isWrite());
+    CHECK(!parseRequest("PING").isWrite());
+    CHECK(!parseRequest("DELETE x").isWrite()); // Invalid requests never act as barriers
+}
+
+// Reads start together; a write waits for all earlier replies and holds back everything after it
+static void testWritesAreBarriers() {
+    std::mutex logMutex;
+    std::vector<std::string> log;
+    auto record = [&](const std::string& event) {
+        std::lock_guard<std::mutex> lock(logMutex);
+        log.push_back(event);
+    };
+
+    std::vector<ServerRequest> batch = {
+        parseRequest("GET 1"), parseRequest("GET 2"), parseRequest("DELETE 3"), parseRequest("GET 4")
+    };
+
+    std::string reply = runPipelinedBatch(batch, [&](const ServerRequest& request) -> ReplyWaiter {
+        std::string tag = std::to_string(request.productId);
+        record("start " + tag);
+        auto done = std::make_shared<std::future<std::string>>(std::async(std::launch::async, [&record, tag] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            record("end " + tag);
+            return tag + ";";
+        }));
+        return [done] { return done->get(); };
+    });
+
+    auto position = [&log](const std::string& event) {
+        return std::find(log.begin(), log.end(), event) - log.begin();
+    };
+
+    CHECK(reply == "1;2;3;4;");                              // Replies stay in request order
+    CHECK(position("start 2") < position("end 1"));          // Reads before the write overlap
+    CHECK(position("start 3") > position("end 1"));          // The write waits for earlier reads...
+    CHECK(position("start 3") > position("end 2"));
+    CHECK(position("start 4") > position("end 3"));          // ...and later reads wait for the write
+}
+
+int main() {
+    testValidRequests();
+    testPartialNumbersAreRejected();
+    testMalformedRequests();
+    testIsWrite();
+    testWritesAreBarriers();
+
+    if (failures != 0) {
+        std::cerr << failures << " check(s) failed." << std::endl;
+        return 1;
+    }
+    std::cout << "All ServerProtocol checks passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,141 @@
+/*
+ * File: tests/WorkStealingPoolTest.cpp
+ * Description: Standalone checks for WorkStealingPool (no database required).
+ * Author: David Paul Desuyo
+ * Date: 2025-06-03
+ */
+
+#include "WorkStealingPool.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                          \
+    do {                                                                          \
+        if (!(condition)) {                                                       \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: "        \
+                      << #condition << std::endl;                                 \
+            ++failures;                                                           \
+        }                                                                         \
+    } while (0)
+
+// Submitting from several threads at once must run every task exactly once
+static void testEveryTaskRunsOnce() {
+    const std::size_t producers = 4;
+    const std::size_t tasksPerProducer = 20000;
+    auto runCounts = std::make_unique<std::atomic<int>[]>(producers * tasksPerProducer);
+    std::atomic<bool> badWorkerIndex(false);
+
+    {
+        WorkStealingPool pool(4);
+        std::vector<std::thread> threads;
+        for (std::size_t p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                for (std::size_t i = 0; i < tasksPerProducer; ++i) {
+                    std::size_t slot = p * tasksPerProducer + i;
+                    pool.submit([&, slot](std::size_t workerIndex) {
+                        if (workerIndex >= pool.size()) {
+                            badWorkerIndex = true;
+                        }
+                        runCounts[slot].fetch_add(1);
+                    });
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+    } // Destructor waits for the queues to drain
+
+    std::size_t wrong = 0;
+    for (std::size_t i = 0; i < producers * tasksPerProducer; ++i) {
+        if (runCounts[i].load() != 1) {
+            ++wrong;
+        }
+    }
+    CHECK(wrong == 0);
+    CHECK(!badWorkerIndex);
+}
+
+// Work still queued when the pool is destroyed must run before the destructor returns
+static void testDestructorDrainsQueuedWork() {
+    std::atomic<int> completed(0);
+    {
+        WorkStealingPool pool(2);
+        for (int i = 0; i < 200; ++i) {
+            pool.submit([&completed](std::size_t) {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                completed.fetch_add(1);
+            });
+        }
+    }
+    CHECK(completed.load() == 200);
+}
+
+// A throwing task must not take its worker down with it
+static void testThrowingTaskDoesNotKillWorker() {
+    std::atomic<int> completed(0);
+    {
+        WorkStealingPool pool(1);
+        pool.submit([](std::size_t) { throw std::runtime_error("expected test failure"); });
+        pool.submit([&completed](std::size_t) { completed.fetch_add(1); });
+    }
+    CHECK(completed.load() == 1);
+}
+
+// Work queued behind a busy worker must be taken by the idle one. Submissions alternate
+// between the two queues, so half of these tasks land behind the blocked worker and can
+// only finish if they are stolen.
+static void testIdleWorkerStealsFromBlockedWorker() {
+    std::atomic<bool> blockerStarted(false);
+    std::atomic<bool> release(false);
+    std::atomic<int> completed(0);
+    {
+        WorkStealingPool pool(2);
+        pool.submit([&](std::size_t) {
+            blockerStarted = true;
+            while (!release) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+        while (!blockerStarted) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        for (int i = 0; i < 10; ++i) {
+            pool.submit([&completed](std::size_t) { completed.fetch_add(1); });
+        }
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (completed.load() < 10 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        CHECK(completed.load() == 10);
+        release = true;
+    }
+}
+
+static void testZeroThreadsMeansOne() {
+    WorkStealingPool pool(0);
+    CHECK(pool.size() == 1);
+}
+
+int main() {
+    testEveryTaskRunsOnce();
+    testDestructorDrainsQueuedWork();
+    testThrowingTaskDoesNotKillWorker();
+    testIdleWorkerStealsFromBlockedWorker();
+    testZeroThreadsMeansOne();
+
+    if (failures != 0) {
+        std::cerr << failures << " check(s) failed." << std::endl;
+        return 1;
+    }
+    std::cout << "All WorkStealingPool checks passed." << std::endl;
+    return 0;
+}